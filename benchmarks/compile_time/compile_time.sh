@@ -0,0 +1,47 @@
+#!/usr/bin/env bash
+# Measures the compile time of operators.cpp with the C++14 (`std::enable_if_t`) and C++20 (concepts) overload sets.
+#
+# Usage: benchmarks/compile_time/compile_time.sh [runs]
+#
+# Set CXX to choose the compiler. With Clang, `-ftime-trace` reports are written to $OUT_DIR (default: a temporary
+# directory) and can be opened in chrome://tracing or https://ui.perfetto.dev.
+set -euo pipefail
+
+root="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+src="${root}/benchmarks/compile_time/operators.cpp"
+cxx="${CXX:-c++}"
+runs="${1:-5}"
+out_dir="${OUT_DIR:-$(mktemp -d)}"
+copies="${KOMORI_COMPILE_TIME_COPIES:-16}"
+
+trace_flags=()
+if "${cxx}" -ftime-trace -x c++ -fsyntax-only /dev/null -o /dev/null 2>/dev/null; then
+  trace_flags=(-ftime-trace)
+fi
+
+# Prints the best wall time of `runs` compilations in seconds.
+measure() {
+  local name="$1"
+  shift
+  local best=""
+  for _ in $(seq "${runs}"); do
+    local begin end elapsed
+    begin=$(date +%s%N)
+    "${cxx}" "$@" "${trace_flags[@]}" -DKOMORI_COMPILE_TIME_COPIES="${copies}" -I"${root}" -c "${src}" \
+      -o "${out_dir}/${name}.o"
+    end=$(date +%s%N)
+    elapsed=$(((end - begin) / 1000000))
+    if [[ -z "${best}" || "${elapsed}" -lt "${best}" ]]; then
+      best="${elapsed}"
+    fi
+  done
+  printf "%-24s %6d ms\n" "${name}" "${best}"
+}
+
+echo "compiler: $("${cxx}" --version | head -n 1), best of ${runs} runs"
+measure cxx14 -std=c++14
+measure cxx20_enable_if -std=c++20 -DKOMORI_NO_CONCEPTS
+measure cxx20_concepts -std=c++20
+if [[ ${#trace_flags[@]} -gt 0 ]]; then
+  echo "time traces: ${out_dir}/*.json"
+fi
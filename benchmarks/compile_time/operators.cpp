@@ -0,0 +1,69 @@
+// A synthetic translation unit which stresses overload resolution of the `sat_t` operators. It is compiled by
+// `compile_time.sh` in C++14 and C++20 to compare the `std::enable_if_t` and concepts-based overload sets.
+#include "komori/saturation_arithmetic.hpp"
+
+#include <cstdint>
+
+#ifndef KOMORI_COMPILE_TIME_COPIES
+#define KOMORI_COMPILE_TIME_COPIES 16
+#endif
+
+namespace {
+using komori::detail::sat_t;
+
+/// `I` only makes every copy a distinct instantiation.
+template <typename T, typename U, int I>
+bool exercise(sat_t<T> x, sat_t<U> y, T a, U b) {
+  auto sum = x + y;
+  sum -= y;
+  sum *= x;
+  sum /= b;
+  const sat_t<T> lhs = x + a;
+  const sat_t<U> rhs = b * y;
+  const auto mixed = (x - y) * (y + x) / (x * y + static_cast<U>(I));
+  return (lhs < rhs) + (lhs == y) + (a != rhs) + (mixed >= x) + (b <= sum) + (sum > a);
+}
+
+template <typename T, typename U, int... Is>
+int exercise_all(T a, U b) {
+  const bool results[] = {exercise<T, U, Is>(sat_t<T>{a}, sat_t<U>{b}, a, b)...};
+  int count = 0;
+  for (const bool result : results) {
+    count += result;
+  }
+  return count;
+}
+
+template <int N, int... Is>
+struct copies : copies<N - 1, N - 1, Is...> {};
+
+template <int... Is>
+struct copies<0, Is...> {
+  template <typename T, typename U>
+  static int run(T a, U b) {
+    return exercise_all<T, U, Is...>(a, b);
+  }
+};
+
+template <typename T, typename U>
+int run(T a, U b) {
+  return copies<KOMORI_COMPILE_TIME_COPIES>::run(a, b);
+}
+}  // namespace
+
+int main(int argc, char** /* argv */) {
+  const auto s = static_cast<std::int8_t>(argc);
+  const auto u = static_cast<std::uint8_t>(argc);
+
+  // Every ordered pair of the same signedness where the second type is at least as wide as the first.
+  return run<std::int8_t, std::int8_t>(s, s) + run<std::int8_t, std::int16_t>(s, s) +
+         run<std::int8_t, std::int32_t>(s, s) + run<std::int8_t, std::int64_t>(s, s) +
+         run<std::int16_t, std::int16_t>(s, s) + run<std::int16_t, std::int32_t>(s, s) +
+         run<std::int16_t, std::int64_t>(s, s) + run<std::int32_t, std::int32_t>(s, s) +
+         run<std::int32_t, std::int64_t>(s, s) + run<std::int64_t, std::int64_t>(s, s) +
+         run<std::uint8_t, std::uint8_t>(u, u) + run<std::uint8_t, std::uint16_t>(u, u) +
+         run<std::uint8_t, std::uint32_t>(u, u) + run<std::uint8_t, std::uint64_t>(u, u) +
+         run<std::uint16_t, std::uint16_t>(u, u) + run<std::uint16_t, std::uint32_t>(u, u) +
+         run<std::uint16_t, std::uint64_t>(u, u) + run<std::uint32_t, std::uint32_t>(u, u) +
+         run<std::uint32_t, std::uint64_t>(u, u) + run<std::uint64_t, std::uint64_t>(u, u);
+}
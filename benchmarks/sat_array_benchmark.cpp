@@ -0,0 +1,119 @@
+#include "komori/sat_array.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using komori::int_sat16_t;
+
+namespace {
+/// The number of buffers allocated per simulated frame.
+constexpr int kBuffersPerFrame = 8;
+
+template <typename Container>
+void fill_random(Container& c) {
+  std::mt19937 engine{334};
+  std::uniform_int_distribution<std::int32_t> dist{std::numeric_limits<std::int16_t>::min(),
+                                                   std::numeric_limits<std::int16_t>::max()};
+  for (auto& x : c) {
+    x = static_cast<std::int16_t>(dist(engine));
+  }
+}
+
+void BM_VectorAllocation(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    for (int i = 0; i < kBuffersPerFrame; ++i) {
+      std::vector<int_sat16_t> v(n);
+      benchmark::DoNotOptimize(v.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBuffersPerFrame);
+}
+
+void BM_ArenaAllocation(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  komori::monotonic_arena arena(kBuffersPerFrame * (n + 64) * sizeof(int_sat16_t));
+  const komori::arena_allocator<int_sat16_t> alloc(arena);
+  for (auto _ : state) {
+    for (int i = 0; i < kBuffersPerFrame; ++i) {
+      komori::arena_sat_array<std::int16_t> v(n, alloc);
+      benchmark::DoNotOptimize(v.data());
+    }
+    arena.reset();
+  }
+  state.SetItemsProcessed(state.iterations() * kBuffersPerFrame);
+}
+
+void BM_VectorAdd(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  std::vector<int_sat16_t> x(n);
+  std::vector<int_sat16_t> y(n);
+  fill_random(x);
+  fill_random(y);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] += y[i];
+    }
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void BM_SatArrayAdd(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  komori::sat_array<std::int16_t> x(n);
+  komori::sat_array<std::int16_t> y(n);
+  fill_random(x);
+  fill_random(y);
+  for (auto _ : state) {
+    x += y;
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void BM_VectorMul(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  std::vector<int_sat16_t> x(n);
+  std::vector<int_sat16_t> y(n);
+  fill_random(x);
+  fill_random(y);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] *= y[i];
+    }
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void BM_SatArrayMul(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  komori::sat_array<std::int16_t> x(n);
+  komori::sat_array<std::int16_t> y(n);
+  fill_random(x);
+  fill_random(y);
+  for (auto _ : state) {
+    x *= y;
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+}  // namespace
+
+BENCHMARK(BM_VectorAllocation)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_ArenaAllocation)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_VectorAdd)->Arg(1000)->Arg(1 << 16);
+BENCHMARK(BM_SatArrayAdd)->Arg(1000)->Arg(1 << 16);
+BENCHMARK(BM_VectorMul)->Arg(1000)->Arg(1 << 16);
+BENCHMARK(BM_SatArrayMul)->Arg(1000)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
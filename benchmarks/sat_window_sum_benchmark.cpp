@@ -0,0 +1,67 @@
+#include "komori/sat_window_sum.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr std::size_t kSamples = 1 << 16;
+
+std::vector<std::int32_t> make_samples() {
+  std::mt19937 engine{334};
+  std::uniform_int_distribution<std::int32_t> dist{0, 1 << 24};
+  std::vector<std::int32_t> samples(kSamples);
+  for (auto& sample : samples) {
+    sample = dist(engine);
+  }
+  return samples;
+}
+
+/// Recomputes the whole window with a fold of `add_sat` on every sample. O(N) per sample.
+template <std::size_t N>
+void BM_FoldWindowSum(benchmark::State& state) {
+  const auto samples = make_samples();
+  std::vector<std::int32_t> sums(samples.size());
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+      std::int32_t sum = 0;
+      for (std::size_t j = i + 1 > N ? i + 1 - N : 0; j <= i; ++j) {
+        sum = komori::add_sat(sum, samples[j]);
+      }
+      sums[i] = sum;
+    }
+    benchmark::DoNotOptimize(sums.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * samples.size()));
+}
+
+/// Uses `sat_window_sums`. O(1) per sample.
+template <std::size_t N>
+void BM_SatWindowSum(benchmark::State& state) {
+  const auto samples = make_samples();
+  std::vector<std::int32_t> sums(samples.size());
+
+  for (auto _ : state) {
+    komori::sat_window_sum<std::int32_t, N> window;
+    komori::sat_window_sums(window, samples.begin(), samples.end(), sums.begin());
+    benchmark::DoNotOptimize(sums.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * samples.size()));
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_FoldWindowSum, 8);
+BENCHMARK_TEMPLATE(BM_FoldWindowSum, 64);
+BENCHMARK_TEMPLATE(BM_FoldWindowSum, 512);
+BENCHMARK_TEMPLATE(BM_FoldWindowSum, 4096);
+BENCHMARK_TEMPLATE(BM_SatWindowSum, 8);
+BENCHMARK_TEMPLATE(BM_SatWindowSum, 64);
+BENCHMARK_TEMPLATE(BM_SatWindowSum, 512);
+BENCHMARK_TEMPLATE(BM_SatWindowSum, 4096);
+
+BENCHMARK_MAIN();
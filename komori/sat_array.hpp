@@ -0,0 +1,450 @@
+#ifndef KOMORI_SAT_ARRAY_HPP_
+#define KOMORI_SAT_ARRAY_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "komori/saturation_arithmetic.hpp"
+
+namespace komori {
+/// The alignment of `sat_array` storage in bytes. It is a multiple of every SIMD register width up to 512 bits.
+constexpr std::size_t kSatArrayAlignment = 64;
+
+/**
+ * @brief A bump allocator over a single fixed-size block.
+ *
+ * Individual deallocations are no-ops. All memory is released at once by `reset()`, e.g. at the end of every frame.
+ */
+class monotonic_arena {
+ public:
+  /**
+   * @brief Allocates the backing block.
+   * @param capacity The size of the block in bytes.
+   * @throw std::bad_alloc The block cannot be allocated.
+   */
+  explicit monotonic_arena(std::size_t capacity)
+      : block_(static_cast<unsigned char*>(::operator new(padded_capacity(capacity)))), capacity_(capacity) {
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block_);
+    begin_ = block_ + (kSatArrayAlignment - address % kSatArrayAlignment) % kSatArrayAlignment;
+  }
+
+  monotonic_arena(const monotonic_arena&) = delete;
+  monotonic_arena(monotonic_arena&&) = delete;
+  monotonic_arena& operator=(const monotonic_arena&) = delete;
+  monotonic_arena& operator=(monotonic_arena&&) = delete;
+  ~monotonic_arena() noexcept { ::operator delete(block_); }
+
+  /**
+   * @brief Allocates `bytes` bytes aligned to `alignment`.
+   * @param bytes The number of bytes to allocate.
+   * @param alignment The alignment. It must be a power of two not greater than `kSatArrayAlignment`.
+   * @return The allocated memory.
+   * @throw std::bad_alloc The arena is exhausted.
+   */
+  void* allocate(std::size_t bytes, std::size_t alignment = kSatArrayAlignment) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment <= kSatArrayAlignment);
+    const std::size_t offset = (used_ + alignment - 1) & ~(alignment - 1);
+    if (offset > capacity_ || bytes > capacity_ - offset) {
+      throw std::bad_alloc();
+    }
+
+    used_ = offset + bytes;
+    return begin_ + offset;
+  }
+
+  /// Does nothing. Memory is reclaimed by `reset()`.
+  void deallocate(void* /* p */, std::size_t /* bytes */) noexcept {}
+
+  /// Releases every allocation at once. Memory allocated before the call must not be used any more.
+  void reset() noexcept { used_ = 0; }
+
+  /// The number of bytes handed out since the last `reset()`, including alignment padding.
+  std::size_t used() const noexcept { return used_; }
+  std::size_t capacity() const noexcept { return capacity_; }
+
+ private:
+  /// The size of the block including the room to align its beginning.
+  static std::size_t padded_capacity(std::size_t capacity) {
+    if (capacity > std::numeric_limits<std::size_t>::max() - kSatArrayAlignment) {
+      throw std::bad_alloc();
+    }
+    return capacity + kSatArrayAlignment;
+  }
+
+  unsigned char* block_;
+  unsigned char* begin_;
+  std::size_t capacity_;
+  std::size_t used_{};
+};
+
+/**
+ * @brief A heap allocator which aligns every allocation to `kAlignment` bytes.
+ * @tparam T The element type.
+ * @tparam kAlignment The alignment. It must be a power of two.
+ */
+template <typename T, std::size_t kAlignment = kSatArrayAlignment>
+class aligned_allocator {
+  static_assert((kAlignment & (kAlignment - 1)) == 0, "kAlignment must be a power of two.");
+
+ public:
+  using value_type = T;
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, kAlignment>;
+  };
+
+  constexpr aligned_allocator() noexcept = default;
+  template <typename U>
+  constexpr aligned_allocator(const aligned_allocator<U, kAlignment>& /* other */) noexcept {}
+
+  T* allocate(std::size_t n) {
+    if (n > (std::numeric_limits<std::size_t>::max() - kAlignment - sizeof(void*)) / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+
+    // Over-allocate, align the result and store the original pointer right before it.
+    void* const raw = ::operator new(n * sizeof(T) + kAlignment + sizeof(void*));
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+    void** const aligned = reinterpret_cast<void**>((address + kAlignment - 1) & ~(kAlignment - 1));
+    aligned[-1] = raw;
+    return reinterpret_cast<T*>(aligned);
+  }
+
+  void deallocate(T* p, std::size_t /* n */) noexcept { ::operator delete(reinterpret_cast<void**>(p)[-1]); }
+
+  template <typename U>
+  constexpr bool operator==(const aligned_allocator<U, kAlignment>& /* other */) const noexcept {
+    return true;
+  }
+  template <typename U>
+  constexpr bool operator!=(const aligned_allocator<U, kAlignment>& /* other */) const noexcept {
+    return false;
+  }
+};
+
+/**
+ * @brief An allocator which takes memory from a `monotonic_arena`.
+ *
+ * It only holds a pointer to the arena, so it is cheap to copy. The arena must outlive every container using it.
+ *
+ * @tparam T The element type.
+ */
+template <typename T>
+class arena_allocator {
+ public:
+  using value_type = T;
+
+  explicit arena_allocator(monotonic_arena& arena) noexcept : arena_(&arena) {}
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& other) noexcept : arena_(other.arena()) {}
+
+  T* allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T*>(arena_->allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept { arena_->deallocate(p, n * sizeof(T)); }
+
+  monotonic_arena* arena() const noexcept { return arena_; }
+
+  template <typename U>
+  bool operator==(const arena_allocator<U>& other) const noexcept {
+    return arena_ == other.arena();
+  }
+  template <typename U>
+  bool operator!=(const arena_allocator<U>& other) const noexcept {
+    return arena_ != other.arena();
+  }
+
+ private:
+  monotonic_arena* arena_;
+};
+
+namespace detail {
+/// A type which holds the sum and the difference of any two `T`s.
+template <typename T>
+using bulk_sum_t = std::conditional_t<(sizeof(T) < sizeof(int)), int, std::int64_t>;
+
+/// A type which holds the product of any two `T`s.
+template <typename T>
+using bulk_product_t =
+    std::conditional_t<(sizeof(T) < sizeof(int)),
+                       std::conditional_t<std::is_signed<T>::value, int, unsigned int>,
+                       std::conditional_t<std::is_signed<T>::value, std::int64_t, std::uint64_t>>;
+
+template <typename T, typename W>
+constexpr T clamp_wide(W v) noexcept {
+  constexpr W kMin = static_cast<W>(std::numeric_limits<T>::min());
+  constexpr W kMax = static_cast<W>(std::numeric_limits<T>::max());
+  return static_cast<T>(v < kMin ? kMin : (v > kMax ? kMax : v));
+}
+
+// The bulk kernels compute in a wider type and clamp. Unlike the overflow builtins, this form is branchless and
+// vectorizes well. 64-bit integers have no wider type and fall back to the scalar functions.
+#define KOMORI_DEFINE_BULK_OPERATION(name, op, wide_t, op_sat)                                             \
+  struct name {                                                                                            \
+    template <typename T, std::enable_if_t<(sizeof(T) < sizeof(std::int64_t)), std::nullptr_t> = nullptr>  \
+    constexpr T operator()(T x, T y) const noexcept {                                                      \
+      return clamp_wide<T>(static_cast<wide_t<T>>(x) op static_cast<wide_t<T>>(y));                        \
+    }                                                                                                      \
+    template <typename T, std::enable_if_t<(sizeof(T) >= sizeof(std::int64_t)), std::nullptr_t> = nullptr> \
+    constexpr T operator()(T x, T y) const noexcept {                                                      \
+      return op_sat(x, y);                                                                                 \
+    }                                                                                                      \
+  };
+
+KOMORI_DEFINE_BULK_OPERATION(bulk_add, +, bulk_sum_t, add_sat);
+KOMORI_DEFINE_BULK_OPERATION(bulk_sub, -, bulk_sum_t, sub_sat);
+KOMORI_DEFINE_BULK_OPERATION(bulk_mul, *, bulk_product_t, mul_sat);
+
+#undef KOMORI_DEFINE_BULK_OPERATION
+
+static_assert(std::is_standard_layout<sat_t<std::int16_t>>::value, "sat_t must be accessible through its value.");
+
+/**
+ * @brief Computes `out[i] = op(x[i], y[i])` for `i` in `[0, n)` in blocks of `kLanes` elements.
+ *
+ * The fixed-size inner loop lets the compiler vectorize without a scalar tail.
+ *
+ * @pre `n` is a multiple of `kLanes`.
+ */
+template <std::size_t kLanes, typename T, typename Op>
+void bulk_apply(sat_t<T>* out, const sat_t<T>* x, const sat_t<T>* y, std::size_t n, Op op) noexcept {
+  T* const o = reinterpret_cast<T*>(out);
+  const T* const a = reinterpret_cast<const T*>(x);
+  const T* const b = reinterpret_cast<const T*>(y);
+  for (std::size_t i = 0; i < n; i += kLanes) {
+    for (std::size_t j = 0; j < kLanes; ++j) {
+      o[i + j] = op(a[i + j], b[i + j]);
+    }
+  }
+}
+
+/// Computes `out[i] = op(x[i], y)` for `i` in `[0, n)`. The same as `bulk_apply` with a broadcast operand.
+template <std::size_t kLanes, typename T, typename Op>
+void bulk_apply(sat_t<T>* out, const sat_t<T>* x, T y, std::size_t n, Op op) noexcept {
+  T* const o = reinterpret_cast<T*>(out);
+  const T* const a = reinterpret_cast<const T*>(x);
+  for (std::size_t i = 0; i < n; i += kLanes) {
+    for (std::size_t j = 0; j < kLanes; ++j) {
+      o[i + j] = op(a[i + j], y);
+    }
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief A fixed-size array of `sat_t<T>` for the bulk kernels.
+ *
+ * The storage is aligned to `kSatArrayAlignment` bytes (with the default or the arena allocator) and its length is
+ * padded to a multiple of `kLanes`, so the element-wise operators run full vector blocks only. The padding is
+ * zero-initialized and its contents are unspecified after any operator.
+ *
+ * @tparam T An integer type.
+ * @tparam Allocator An allocator of `sat_t<T>`.
+ */
+template <typename T, typename Allocator = aligned_allocator<detail::sat_t<T>>>
+class sat_array {
+ public:
+  using value_type = detail::sat_t<T>;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+
+  static_assert(std::is_same<typename std::allocator_traits<Allocator>::value_type, value_type>::value,
+                "Allocator must allocate sat_t<T>.");
+
+  /// The number of elements in one block of `kSatArrayAlignment` bytes.
+  static constexpr std::size_t kLanes = kSatArrayAlignment / sizeof(T);
+
+  explicit sat_array(std::size_t size, const Allocator& alloc = Allocator())
+      : alloc_(alloc), data_(allocate(size)), size_(size) {}
+
+  sat_array(std::size_t size, value_type value, const Allocator& alloc = Allocator()) : sat_array(size, alloc) {
+    std::fill(begin(), end(), value);
+  }
+
+  sat_array(std::initializer_list<value_type> init, const Allocator& alloc = Allocator())
+      : sat_array(init.size(), alloc) {
+    std::copy(init.begin(), init.end(), begin());
+  }
+
+  sat_array(const sat_array& other)
+      : sat_array(other.size_,
+                  std::allocator_traits<Allocator>::select_on_container_copy_construction(other.alloc_)) {
+    std::copy(other.begin(), other.end(), begin());
+  }
+
+  sat_array(sat_array&& other) noexcept
+      : alloc_(std::move(other.alloc_)),
+        data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, std::size_t{0})) {}
+
+  sat_array& operator=(const sat_array& other) {
+    if (this != &other) {
+      if (size_ != other.size_) {
+        sat_array tmp(other.size_, alloc_);
+        swap(tmp);
+      }
+      std::copy(other.begin(), other.end(), begin());
+    }
+    return *this;
+  }
+
+  sat_array& operator=(sat_array&& other) noexcept {
+    sat_array tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+
+  ~sat_array() noexcept {
+    if (data_ != nullptr) {
+      std::allocator_traits<Allocator>::deallocate(alloc_, data_, padded_size());
+    }
+  }
+
+  void swap(sat_array& other) noexcept {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+    swap(data_, other.data_);
+    swap(size_, other.size_);
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  value_type* data() noexcept { return data_; }
+  const value_type* data() const noexcept { return data_; }
+  std::size_t size() const noexcept { return size_; }
+  /// The number of allocated elements, i.e. `size()` rounded up to a multiple of `kLanes`.
+  std::size_t padded_size() const noexcept { return pad(size_); }
+  bool empty() const noexcept { return size_ == 0; }
+
+  value_type& operator[](std::size_t i) noexcept { return data_[i]; }
+  const value_type& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+  iterator begin() noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+
+ private:
+  static constexpr std::size_t pad(std::size_t n) noexcept { return (n + kLanes - 1) / kLanes * kLanes; }
+
+  value_type* allocate(std::size_t n) {
+    if (n == 0) {
+      return nullptr;
+    }
+    // `pad(n)` would wrap around.
+    if (n > std::numeric_limits<std::size_t>::max() - (kLanes - 1)) {
+      throw std::bad_alloc();
+    }
+
+    value_type* const p = std::allocator_traits<Allocator>::allocate(alloc_, pad(n));
+    std::fill(p, p + pad(n), value_type{});
+    return p;
+  }
+
+  Allocator alloc_;
+  value_type* data_;
+  std::size_t size_;
+};
+
+template <typename T, typename Allocator>
+constexpr std::size_t sat_array<T, Allocator>::kLanes;
+
+/// A `sat_array` which takes its memory from a `monotonic_arena`.
+template <typename T>
+using arena_sat_array = sat_array<T, arena_allocator<detail::sat_t<T>>>;
+
+/**
+ * @brief Element-wise `+`, `-` and `*` of two arrays, or of an array and a scalar.
+ *
+ * They run over the whole padded storage. The result takes its memory from the allocator of `x`.
+ *
+ * @pre For two arrays, `x.size() == y.size()`. It is checked by `assert` only.
+ */
+#define KOMORI_DEFINE_SAT_ARRAY_OPERATORS(op, bulk_op)                                                   \
+  template <typename T, typename A>                                                                      \
+  sat_array<T, A>& operator op##=(sat_array<T, A>& x, const sat_array<T, A>& y) noexcept {               \
+    assert(x.size() == y.size());                                                                        \
+    constexpr std::size_t kLanes = sat_array<T, A>::kLanes;                                              \
+    detail::bulk_apply<kLanes>(x.data(), x.data(), y.data(), x.padded_size(), detail::bulk_op{});        \
+    return x;                                                                                            \
+  }                                                                                                      \
+  template <typename T, typename A>                                                                      \
+  sat_array<T, A>& operator op##=(sat_array<T, A>& x, typename sat_array<T, A>::value_type y) noexcept { \
+    constexpr std::size_t kLanes = sat_array<T, A>::kLanes;                                              \
+    detail::bulk_apply<kLanes>(x.data(), x.data(), y.value(), x.padded_size(), detail::bulk_op{});       \
+    return x;                                                                                            \
+  }                                                                                                      \
+  template <typename T, typename A>                                                                      \
+  sat_array<T, A> operator op(const sat_array<T, A>& x, const sat_array<T, A>& y) {                      \
+    assert(x.size() == y.size());                                                                        \
+    constexpr std::size_t kLanes = sat_array<T, A>::kLanes;                                              \
+    sat_array<T, A> result(x.size(), x.get_allocator());                                                 \
+    detail::bulk_apply<kLanes>(result.data(), x.data(), y.data(), x.padded_size(), detail::bulk_op{});   \
+    return result;                                                                                       \
+  }                                                                                                      \
+  template <typename T, typename A>                                                                      \
+  sat_array<T, A> operator op(const sat_array<T, A>& x, typename sat_array<T, A>::value_type y) {        \
+    constexpr std::size_t kLanes = sat_array<T, A>::kLanes;                                              \
+    sat_array<T, A> result(x.size(), x.get_allocator());                                                 \
+    detail::bulk_apply<kLanes>(result.data(), x.data(), y.value(), x.padded_size(), detail::bulk_op{});  \
+    return result;                                                                                       \
+  }
+
+KOMORI_DEFINE_SAT_ARRAY_OPERATORS(+, bulk_add);
+KOMORI_DEFINE_SAT_ARRAY_OPERATORS(-, bulk_sub);
+KOMORI_DEFINE_SAT_ARRAY_OPERATORS(*, bulk_mul);
+
+#undef KOMORI_DEFINE_SAT_ARRAY_OPERATORS
+
+/**
+ * @brief Element-wise `/` of two arrays, or of an array and a scalar.
+ *
+ * Division has no vector instruction, and the zero padding of a divisor must not be divided by. Thus it only
+ * processes the first `size()` elements.
+ *
+ * @pre For two arrays, `x.size() == y.size()`. It is checked by `assert` only. No divisor is zero.
+ */
+template <typename T, typename A>
+sat_array<T, A>& operator/=(sat_array<T, A>& x, const sat_array<T, A>& y) noexcept {
+  assert(x.size() == y.size());
+  std::transform(x.begin(), x.end(), y.begin(), x.begin(), [](auto a, auto b) { return a / b; });
+  return x;
+}
+
+template <typename T, typename A>
+sat_array<T, A>& operator/=(sat_array<T, A>& x, typename sat_array<T, A>::value_type y) noexcept {
+  std::transform(x.begin(), x.end(), x.begin(), [y](auto a) { return a / y; });
+  return x;
+}
+
+template <typename T, typename A>
+sat_array<T, A> operator/(const sat_array<T, A>& x, const sat_array<T, A>& y) {
+  assert(x.size() == y.size());
+  sat_array<T, A> result(x.size(), x.get_allocator());
+  std::transform(x.begin(), x.end(), y.begin(), result.begin(), [](auto a, auto b) { return a / b; });
+  return result;
+}
+
+template <typename T, typename A>
+sat_array<T, A> operator/(const sat_array<T, A>& x, typename sat_array<T, A>::value_type y) {
+  sat_array<T, A> result(x.size(), x.get_allocator());
+  std::transform(x.begin(), x.end(), result.begin(), [y](auto a) { return a / y; });
+  return result;
+}
+}  // namespace komori
+
+#endif  // KOMORI_SAT_ARRAY_HPP_
@@ -0,0 +1,191 @@
+#ifndef KOMORI_SAT_STREAM_HPP_
+#define KOMORI_SAT_STREAM_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <future>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "komori/sat_array.hpp"
+#include "komori/saturation_arithmetic.hpp"
+
+namespace komori {
+/// A saturating operation in a `sat_chain`.
+enum class sat_op {
+  kAdd,
+  kSub,
+  kMul,
+  kDiv,
+};
+
+/**
+ * @brief An ordered chain of saturating operations with a constant operand, e.g. a gain followed by an offset.
+ * @tparam T The integer type which the operations are computed in.
+ */
+template <typename T>
+class sat_chain {
+ public:
+  struct stage {
+    sat_op op;
+    detail::sat_t<T> operand;
+  };
+
+  /**
+   * @brief Appends `x = op(x, operand)`.
+   *
+   * If `T` is unsigned, adding a negative `operand` is stored as subtracting its magnitude, and vice versa.
+   *
+   * @param op The operation.
+   * @param operand The operand. It is saturated to `T`.
+   * @throw std::invalid_argument `op` is `sat_op::kDiv` and `operand` saturates to zero, or `T` is unsigned, `op` is
+   * `sat_op::kMul` or `sat_op::kDiv` and `operand` is negative.
+   */
+  template <typename U, std::enable_if_t<std::is_integral<U>::value, std::nullptr_t> = nullptr>
+  sat_chain& then(sat_op op, U operand) {
+    if (std::is_unsigned<T>::value && std::is_signed<U>::value && static_cast<std::intmax_t>(operand) < 0) {
+      const std::uint64_t magnitude = std::uint64_t{0} - static_cast<std::uint64_t>(operand);
+      switch (op) {
+        case sat_op::kAdd:
+          return then(sat_op::kSub, magnitude);
+        case sat_op::kSub:
+          return then(sat_op::kAdd, magnitude);
+        case sat_op::kMul:
+        case sat_op::kDiv:
+          throw std::invalid_argument("sat_chain: negative operand for an unsigned type");
+      }
+    }
+
+    const T value = saturate_cast<T>(operand);
+    if (op == sat_op::kDiv && value == T{0}) {
+      throw std::invalid_argument("sat_chain: division by zero");
+    }
+
+    stages_.push_back({op, detail::sat_t<T>{value}});
+    return *this;
+  }
+
+  /// Applies every stage in order to all the elements of `x`, including the padding.
+  template <typename A>
+  void apply(sat_array<T, A>& x) const noexcept {
+    for (const auto& s : stages_) {
+      switch (s.op) {
+        case sat_op::kAdd:
+          x += s.operand;
+          break;
+        case sat_op::kSub:
+          x -= s.operand;
+          break;
+        case sat_op::kMul:
+          x *= s.operand;
+          break;
+        case sat_op::kDiv:
+          x /= s.operand;
+          break;
+      }
+    }
+  }
+
+  const std::vector<stage>& stages() const noexcept { return stages_; }
+
+ private:
+  std::vector<stage> stages_;
+};
+
+/// The result of `sat_transform_stream`.
+struct sat_stream_stats {
+  std::uint64_t samples;
+  std::uint64_t bytes_read;
+  std::uint64_t bytes_written;
+  double seconds;
+};
+
+namespace detail {
+/// Reads up to `x.size()` samples. Returns the number of samples read, which is less than `x.size()` only at EOF.
+template <typename T>
+std::size_t read_samples(std::FILE* in, sat_array<T>& x) {
+  const std::size_t bytes = std::fread(x.data(), 1, x.size() * sizeof(T), in);
+  if (std::ferror(in)) {
+    throw std::runtime_error("sat_transform_stream: read error");
+  }
+  if (bytes % sizeof(T) != 0) {
+    throw std::runtime_error("sat_transform_stream: the input ends with a partial sample");
+  }
+  return bytes / sizeof(T);
+}
+
+template <typename T>
+void write_samples(std::FILE* out, const sat_array<T>& x, std::size_t n) {
+  if (std::fwrite(x.data(), sizeof(T), n, out) != n) {
+    throw std::runtime_error("sat_transform_stream: write error");
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief Streams native-endian `In` samples from `in`, applies `chain` and writes them to `out` as `Out`.
+ *
+ * The input is processed in chunks of `chunk_samples` samples, so the memory usage does not depend on the file size.
+ * Two input and two output buffers are used: while one chunk is computed, the next chunk is read and the previous one
+ * is written in the background. The final conversion to `Out` saturates.
+ *
+ * @param in The input stream opened in binary mode.
+ * @param out The output stream opened in binary mode.
+ * @param chain The operations to apply, computed in `In`.
+ * @param chunk_samples The number of samples per chunk.
+ * @return The number of processed samples and bytes, and the elapsed time.
+ * @throw std::runtime_error An I/O error occurred, or the input size is not a multiple of `sizeof(In)`.
+ */
+template <typename In, typename Out>
+sat_stream_stats sat_transform_stream(std::FILE* in,
+                                      std::FILE* out,
+                                      const sat_chain<In>& chain,
+                                      std::size_t chunk_samples = std::size_t{1} << 20) {
+  const auto begin = std::chrono::steady_clock::now();
+  chunk_samples = std::max<std::size_t>(chunk_samples, 1);
+
+  sat_array<In> inputs[2] = {sat_array<In>(chunk_samples), sat_array<In>(chunk_samples)};
+  sat_array<Out> outputs[2] = {sat_array<Out>(chunk_samples), sat_array<Out>(chunk_samples)};
+  std::future<std::size_t> pending_read;
+  std::future<void> pending_write;
+  std::uint64_t samples = 0;
+
+  std::size_t n = detail::read_samples(in, inputs[0]);
+  for (std::size_t i = 0; n > 0; i ^= 1) {
+    // The next read only touches the other input buffer, so it can run while this chunk is computed.
+    sat_array<In>& next = inputs[i ^ 1];
+    pending_read = std::async(std::launch::async, [in, &next] { return detail::read_samples(in, next); });
+
+    chain.apply(inputs[i]);
+    std::transform(inputs[i].begin(), inputs[i].begin() + n, outputs[i].begin(),
+                   [](detail::sat_t<In> x) { return static_cast<detail::sat_t<Out>>(x); });
+
+    // The previous write uses the other output buffer. Wait for it to keep the writes in order.
+    if (pending_write.valid()) {
+      pending_write.get();
+    }
+    const sat_array<Out>& current = outputs[i];
+    pending_write = std::async(std::launch::async, [out, &current, n] { detail::write_samples(out, current, n); });
+
+    samples += n;
+    n = pending_read.get();
+  }
+
+  if (pending_write.valid()) {
+    pending_write.get();
+  }
+  if (std::fflush(out) != 0) {
+    throw std::runtime_error("sat_transform_stream: write error");
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  return {samples, samples * sizeof(In), samples * sizeof(Out), std::chrono::duration<double>(end - begin).count()};
+}
+}  // namespace komori
+
+#endif  // KOMORI_SAT_STREAM_HPP_
@@ -0,0 +1,111 @@
+#ifndef KOMORI_SAT_WINDOW_SUM_HPP_
+#define KOMORI_SAT_WINDOW_SUM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "komori/saturation_arithmetic.hpp"
+
+namespace komori {
+/**
+ * @brief Sum of the last `kWindow` samples, saturated to `T` on read.
+ *
+ * `add_sat` is not invertible, so a saturated running sum cannot drop its oldest sample. This class instead keeps the
+ * exact sum in a 64-bit accumulator and saturates it only in `value()`. Both `push()` and `pop()` are O(1).
+ *
+ * `value()` is `saturate_cast<T>` of the exact sum of the samples in the window. It equals the left fold of `add_sat`
+ * over the window whenever the fold never saturates in the middle (e.g. when all samples have the same sign).
+ *
+ * @tparam T An integer type whose width is at most 32 bits.
+ * @tparam kWindow The window size.
+ */
+template <typename T, std::size_t kWindow>
+class sat_window_sum {
+  static_assert(std::is_integral<T>::value, "T must be an integral type.");
+  static_assert(sizeof(T) <= sizeof(std::int32_t), "T must be at most 32 bits wide.");
+  static_assert(kWindow > 0, "kWindow must be positive.");
+
+ public:
+  /// The type of the exact internal sum.
+  using accumulator_type = std::conditional_t<std::is_signed<T>::value, std::int64_t, std::uint64_t>;
+
+  static_assert(static_cast<std::uint64_t>(kWindow) <=
+                    static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) /
+                        (static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + 1),
+                "kWindow is too large for the internal accumulator.");
+
+  /// The window size.
+  static constexpr std::size_t capacity() noexcept { return kWindow; }
+
+  /**
+   * @brief Appends a sample. The oldest sample is dropped if the window is full.
+   * @param x The sample to append.
+   */
+  constexpr void push(T x) noexcept {
+    if (size_ == kWindow) {
+      sum_ -= buf_[head_];
+    } else {
+      ++size_;
+    }
+    buf_[head_] = x;
+    sum_ += x;
+    head_ = head_ + 1 == kWindow ? 0 : head_ + 1;
+  }
+
+  /**
+   * @brief Drops the oldest sample.
+   * @pre `!empty()`
+   */
+  constexpr void pop() noexcept {
+    const std::size_t tail = head_ >= size_ ? head_ - size_ : head_ + kWindow - size_;
+    sum_ -= buf_[tail];
+    --size_;
+  }
+
+  /// Drops all samples.
+  constexpr void clear() noexcept {
+    head_ = 0;
+    size_ = 0;
+    sum_ = 0;
+  }
+
+  /// The sum of the samples in the window with saturation.
+  constexpr T value() const noexcept { return saturate_cast<T>(sum_); }
+  /// The exact sum of the samples in the window.
+  constexpr accumulator_type sum() const noexcept { return sum_; }
+  /// The number of samples in the window.
+  constexpr std::size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr bool full() const noexcept { return size_ == kWindow; }
+
+ private:
+  T buf_[kWindow]{};
+  std::size_t head_{};
+  std::size_t size_{};
+  accumulator_type sum_{};
+};
+
+/**
+ * @brief Pushes every sample in `[first, last)` to `window` and writes `window.value()` after each push.
+ *
+ * The window keeps its state between calls, so a long stream can be processed chunk by chunk.
+ *
+ * @param window The window to push samples to.
+ * @param first The beginning of the input samples.
+ * @param last The end of the input samples.
+ * @param out The beginning of the output. It must have room for `std::distance(first, last)` values.
+ * @return The end of the output.
+ */
+template <typename T, std::size_t kWindow, typename InputIt, typename OutputIt>
+constexpr OutputIt sat_window_sums(sat_window_sum<T, kWindow>& window, InputIt first, InputIt last, OutputIt out) {
+  for (; first != last; ++first, ++out) {
+    window.push(*first);
+    *out = window.value();
+  }
+  return out;
+}
+}  // namespace komori
+
+#endif  // KOMORI_SAT_WINDOW_SUM_HPP_
@@ -24,6 +24,18 @@
 #define KOMORI_HAS_BUILTIN(x) 0
 #endif
 
+// In C++20, constrain the overloads with concepts instead of `std::enable_if_t`. It yields fewer candidates per
+// operator and avoids instantiating `promoted_type` during overload resolution, which is noticeably cheaper to compile.
+// Define `KOMORI_NO_CONCEPTS` to force the C++14 overloads. Only the feature-test macros are checked because MSVC
+// reports `__cplusplus` as 199711L unless `/Zc:__cplusplus` is given.
+#if !defined(KOMORI_NO_CONCEPTS) && defined(__cpp_concepts) && __cpp_concepts >= 201907L && \
+    defined(__cpp_conditional_explicit) && defined(__cpp_impl_three_way_comparison)
+#define KOMORI_HAS_CONCEPTS 1
+#include <compare>
+#else
+#define KOMORI_HAS_CONCEPTS 0
+#endif
+
 namespace komori {
 namespace detail {
 template <typename T>
@@ -217,12 +229,38 @@ struct promoted_type {
       conditional_t<is_same_signedness<T, U>::value, std::conditional_t<(sizeof(T) > sizeof(U)), T, U>, std::nullptr_t>;
 };
 
+#if KOMORI_HAS_CONCEPTS
+template <typename T, typename U>
+concept same_signedness = std::is_integral_v<T> && std::is_integral_v<U> && std::is_signed_v<T> == std::is_signed_v<U>;
+
+template <typename T, typename U>
+using promoted_t = std::conditional_t<(sizeof(T) > sizeof(U)), T, U>;
+
+/// `promoted_type<T, U>::type` is `P`.
+template <typename T, typename U, typename P>
+concept promotes_to = same_signedness<T, U> && std::is_same_v<promoted_t<T, U>, P>;
+#endif
+
 template <typename T>
 class sat_t {
   static_assert(std::is_integral<T>::value, "T must be an integral type.");
 
  public:
   KOMORI_CONSTEXPR_CPP20 sat_t() noexcept = default;
+#if KOMORI_HAS_CONCEPTS
+  template <typename U>
+    requires std::is_integral_v<U>
+  explicit(!promotes_to<T, U, T>) constexpr sat_t(U x) noexcept : value_(saturate_cast<T>(x)) {}
+
+  constexpr sat_t(const sat_t&) noexcept = default;
+  constexpr sat_t(sat_t&&) noexcept = default;
+  template <typename U>
+    requires promotes_to<T, U, T>
+  constexpr sat_t& operator=(U x) noexcept {
+    value_ = static_cast<T>(x);
+    return *this;
+  }
+#else
   template <typename U,
             std::enable_if_t<std::is_same<T, typename promoted_type<T, U>::type>::value, std::nullptr_t> = nullptr>
   constexpr sat_t(U x) noexcept : value_(static_cast<T>(x)) {}
@@ -239,6 +277,7 @@ class sat_t {
     value_ = static_cast<T>(x);
     return *this;
   }
+#endif
   constexpr sat_t& operator=(const sat_t&) noexcept = default;
   constexpr sat_t& operator=(sat_t&&) noexcept = default;
   KOMORI_CONSTEXPR_CPP20 ~sat_t() noexcept = default;
@@ -248,6 +287,13 @@ class sat_t {
     return {saturate_cast<U>(value_)};
   }
 
+#if KOMORI_HAS_CONCEPTS
+  template <typename U>
+    requires std::is_integral_v<U>
+  explicit(!promotes_to<T, U, U>) constexpr operator U() const noexcept {
+    return saturate_cast<U>(value_);
+  }
+#else
   template <typename U,
             std::enable_if_t<std::is_same<U, typename promoted_type<T, U>::type>::value, std::nullptr_t> = nullptr>
   constexpr operator U() const noexcept {
@@ -259,6 +305,7 @@ class sat_t {
   explicit constexpr operator U() const noexcept {
     return saturate_cast<U>(value_);
   }
+#endif
 
   explicit constexpr operator bool() const noexcept { return value_ != 0; }
   constexpr T value() const noexcept { return static_cast<T>(value_); }
@@ -267,6 +314,87 @@ class sat_t {
   T value_;
 };
 
+#if KOMORI_HAS_CONCEPTS
+template <typename T>
+struct underlying {
+  using type = T;
+};
+
+template <typename T>
+struct underlying<sat_t<T>> {
+  using type = T;
+};
+
+template <typename T>
+using underlying_t = typename underlying<T>::type;
+
+template <typename T>
+constexpr T underlying_value(T x) noexcept {
+  return x;
+}
+
+template <typename T>
+constexpr T underlying_value(sat_t<T> x) noexcept {
+  return x.value();
+}
+
+template <typename T>
+concept saturated = !std::is_same_v<T, underlying_t<T>>;
+
+/// Two `sat_t`s of the same signedness, or a `sat_t` and an integer which it can hold without saturation.
+template <typename L, typename R>
+concept sat_operands = (saturated<L> && saturated<R> && same_signedness<underlying_t<L>, underlying_t<R>>) ||
+                       (saturated<L> && promotes_to<underlying_t<L>, R, underlying_t<L>>) ||
+                       (saturated<R> && promotes_to<L, underlying_t<R>, underlying_t<R>>);
+
+// `!=`, `<`, `>`, `<=`, `>=` and the reversed operand orders are rewritten to these by the compiler.
+template <typename T, typename U>
+  requires same_signedness<T, U>
+constexpr bool operator==(sat_t<T> x, sat_t<U> y) noexcept {
+  return x.value() == y.value();
+}
+
+template <typename T, typename U>
+  requires same_signedness<T, U>
+constexpr bool operator==(sat_t<T> x, U y) noexcept {
+  return x.value() == y;
+}
+
+template <typename T, typename U>
+  requires same_signedness<T, U>
+constexpr auto operator<=>(sat_t<T> x, sat_t<U> y) noexcept {
+  using common = std::common_type_t<T, U>;
+  return static_cast<common>(x.value()) <=> static_cast<common>(y.value());
+}
+
+template <typename T, typename U>
+  requires same_signedness<T, U>
+constexpr auto operator<=>(sat_t<T> x, U y) noexcept {
+  using common = std::common_type_t<T, U>;
+  return static_cast<common>(x.value()) <=> static_cast<common>(y);
+}
+
+#define KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS(op, op_sat)                                           \
+  template <typename L, typename R>                                                                        \
+    requires sat_operands<L, R>                                                                            \
+  constexpr sat_t<promoted_t<underlying_t<L>, underlying_t<R>>> operator op(L x, R y) noexcept {           \
+    using promoted = promoted_t<underlying_t<L>, underlying_t<R>>;                                         \
+    return op_sat(static_cast<promoted>(underlying_value(x)), static_cast<promoted>(underlying_value(y))); \
+  }                                                                                                        \
+  template <typename T, typename U>                                                                        \
+    requires promotes_to<T, underlying_t<U>, T>                                                            \
+  constexpr sat_t<T>& operator op##=(sat_t<T>& x, U y) noexcept {                                          \
+    x = op_sat(x.value(), static_cast<T>(underlying_value(y)));                                            \
+    return x;                                                                                              \
+  }
+
+KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS(+, add_sat);
+KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS(-, sub_sat);
+KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS(*, mul_sat);
+KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS(/, div_sat);
+
+#undef KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS
+#else
 #define KOMORI_DEFINE_SATURATED_COMPARISON_OPERATORS(op)                                                         \
   template <typename T, typename U, std::enable_if_t<is_same_signedness<T, U>::value, std::nullptr_t> = nullptr> \
   constexpr bool operator op(sat_t<T> x, sat_t<U> y) noexcept {                                                  \
@@ -325,6 +453,7 @@ KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS(*, mul_sat);
 KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS(/, div_sat);
 
 #undef KOMORI_DEFINE_SATURATED_ARITHMETIC_OPERATORS
+#endif
 
 template <typename T>
 constexpr sat_t<T> operator-(sat_t<T> x) noexcept {
@@ -374,6 +503,7 @@ struct hash<komori::detail::sat_t<T>> {
 }  // namespace std
 
 #undef KOMORI_HAS_BUILTIN
+#undef KOMORI_HAS_CONCEPTS
 #undef KOMORI_CONSTEXPR_CPP17
 #undef KOMORI_CONSTEXPR_CPP20
 
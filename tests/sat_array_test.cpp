@@ -0,0 +1,194 @@
+#include "komori/sat_array.hpp"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+using komori::arena_allocator;
+using komori::arena_sat_array;
+using komori::int_sat16_t;
+using komori::kSatArrayAlignment;
+using komori::monotonic_arena;
+using komori::sat_array;
+
+namespace {
+bool is_aligned(const void* p) {
+  return reinterpret_cast<std::uintptr_t>(p) % kSatArrayAlignment == 0;
+}
+
+using integers = testing::Types<std::int8_t,
+                                std::int16_t,
+                                std::int32_t,
+                                std::int64_t,
+                                std::uint8_t,
+                                std::uint16_t,
+                                std::uint32_t,
+                                std::uint64_t>;
+
+template <typename T>
+class SatArrayTypedTest : public testing::Test {};
+}  // namespace
+
+TEST(SatArrayTest, Layout) {
+  const sat_array<std::int16_t> a(33);
+
+  EXPECT_EQ(a.size(), 33U);
+  EXPECT_EQ(a.padded_size(), 64U);
+  EXPECT_EQ(sat_array<std::int16_t>::kLanes, 32U);
+  EXPECT_TRUE(is_aligned(a.data()));
+  for (const auto& x : a) {
+    EXPECT_EQ(x, 0);
+  }
+
+  const sat_array<std::int16_t> empty(0);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.padded_size(), 0U);
+}
+
+TEST(SatArrayTest, CopyAndMove) {
+  sat_array<std::int16_t> a{std::int16_t{1}, std::int16_t{2}, std::int16_t{3}};
+
+  sat_array<std::int16_t> b = a;
+  EXPECT_EQ(b.size(), 3U);
+  EXPECT_EQ(b[2], 3);
+
+  b[0] = std::int16_t{10};
+  EXPECT_EQ(a[0], 1);
+
+  const sat_array<std::int16_t> c = std::move(b);
+  EXPECT_EQ(c[0], 10);
+  EXPECT_TRUE(b.empty());  // NOLINT(bugprone-use-after-move)
+
+  a = c;
+  EXPECT_EQ(a[0], 10);
+
+  a = sat_array<std::int16_t>(100, std::int16_t{7});
+  EXPECT_EQ(a.size(), 100U);
+  EXPECT_EQ(a[99], 7);
+}
+
+TEST(SatArrayTest, Arena) {
+  monotonic_arena arena(1024);
+  const arena_allocator<int_sat16_t> alloc(arena);
+
+  {
+    const arena_sat_array<std::int16_t> a(10, alloc);
+    const arena_sat_array<std::int16_t> b(10, alloc);
+    EXPECT_TRUE(is_aligned(a.data()));
+    EXPECT_TRUE(is_aligned(b.data()));
+    EXPECT_EQ(arena.used(), 2 * kSatArrayAlignment);
+
+    // The result of an operator takes its memory from the left operand's allocator.
+    const arena_sat_array<std::int16_t> c = a + b;
+    EXPECT_EQ(c.get_allocator(), alloc);
+    EXPECT_EQ(arena.used(), 3 * kSatArrayAlignment);
+  }
+
+  arena.reset();
+  EXPECT_EQ(arena.used(), 0U);
+  EXPECT_THROW(arena_sat_array<std::int16_t>(1000, alloc), std::bad_alloc);
+
+  // The allocator also works with standard containers.
+  arena.reset();
+  std::vector<int_sat16_t, arena_allocator<int_sat16_t>> v(16, alloc);
+  EXPECT_TRUE(is_aligned(v.data()));
+}
+
+TEST(SatArrayTest, HugeSize) {
+  constexpr std::size_t kMaxSize = std::numeric_limits<std::size_t>::max();
+
+  // Padding these sizes to a multiple of the lanes would wrap around.
+  EXPECT_THROW(sat_array<std::int16_t>{kMaxSize}, std::bad_alloc);
+  EXPECT_THROW(sat_array<std::int16_t>(kMaxSize - 1, std::int16_t{1}), std::bad_alloc);
+  EXPECT_THROW(sat_array<std::int8_t>(kMaxSize - sat_array<std::int8_t>::kLanes + 2), std::bad_alloc);
+
+  EXPECT_THROW(monotonic_arena{kMaxSize}, std::bad_alloc);
+  EXPECT_THROW(monotonic_arena(kMaxSize - kSatArrayAlignment + 1), std::bad_alloc);
+}
+
+TEST(SatArrayTest, Operators) {
+  constexpr std::int16_t kMax = std::numeric_limits<std::int16_t>::max();
+  constexpr std::int16_t kMin = std::numeric_limits<std::int16_t>::min();
+  const sat_array<std::int16_t> a{kMax, kMin, std::int16_t{300}, std::int16_t{-7}};
+  const sat_array<std::int16_t> b{std::int16_t{1}, std::int16_t{1}, std::int16_t{200}, std::int16_t{2}};
+
+  const auto sum = a + b;
+  EXPECT_EQ(sum[0], kMax);
+  EXPECT_EQ(sum[1], kMin + 1);
+  EXPECT_EQ(sum[2], 500);
+  EXPECT_EQ(sum[3], -5);
+
+  const auto diff = a - b;
+  EXPECT_EQ(diff[0], kMax - 1);
+  EXPECT_EQ(diff[1], kMin);
+
+  const auto product = a * b;
+  EXPECT_EQ(product[2], kMax);
+  EXPECT_EQ(product[3], -14);
+
+  const auto quotient = a / b;
+  EXPECT_EQ(quotient[2], 1);
+  EXPECT_EQ(quotient[3], -3);
+
+  auto c = a;
+  c *= int_sat16_t{-1};
+  EXPECT_EQ(c[0], -kMax);
+  EXPECT_EQ(c[1], kMax);
+  c /= std::int16_t{-1};
+  EXPECT_EQ(c[0], kMax);
+  c += b;
+  EXPECT_EQ(c[2], 500);
+  c -= std::int16_t{1};
+  EXPECT_EQ(c[2], 499);
+}
+
+#ifndef NDEBUG
+TEST(SatArrayDeathTest, SizeMismatch) {
+  sat_array<std::int16_t> a(100);
+  const sat_array<std::int16_t> b(10);
+
+  EXPECT_DEATH(a += b, "");
+  EXPECT_DEATH(a * b, "");
+  EXPECT_DEATH(a /= b, "");
+  EXPECT_DEATH(a / b, "");
+}
+#endif
+
+TYPED_TEST_SUITE(SatArrayTypedTest, integers);
+TYPED_TEST(SatArrayTypedTest, MatchesScalar) {
+  using sat = komori::detail::sat_t<TypeParam>;
+  constexpr TypeParam kMin = std::numeric_limits<TypeParam>::min();
+  constexpr TypeParam kMax = std::numeric_limits<TypeParam>::max();
+  const std::vector<TypeParam> values{kMin,
+                                      static_cast<TypeParam>(kMin + 1),
+                                      static_cast<TypeParam>(kMin / 2),
+                                      static_cast<TypeParam>(-1),
+                                      0,
+                                      1,
+                                      2,
+                                      static_cast<TypeParam>(kMax / 2),
+                                      static_cast<TypeParam>(kMax - 1),
+                                      kMax};
+
+  // Every pair of `values`, with a size which is not a multiple of the lanes.
+  sat_array<TypeParam> x(values.size() * values.size());
+  sat_array<TypeParam> y(values.size() * values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    for (std::size_t j = 0; j < values.size(); ++j) {
+      x[i * values.size() + j] = values[i];
+      y[i * values.size() + j] = values[j];
+    }
+  }
+
+  const auto sum = x + y;
+  const auto diff = x - y;
+  const auto product = x * y;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    ASSERT_EQ(sum[i], sat{x[i]} + sat{y[i]}) << "i: " << i;
+    ASSERT_EQ(diff[i], sat{x[i]} - sat{y[i]}) << "i: " << i;
+    ASSERT_EQ(product[i], sat{x[i]} * sat{y[i]}) << "i: " << i;
+  }
+}
@@ -0,0 +1,124 @@
+#include "komori/sat_stream.hpp"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using komori::sat_chain;
+using komori::sat_op;
+using komori::sat_transform_stream;
+using komori::saturate_cast;
+
+namespace {
+struct file_closer {
+  void operator()(std::FILE* fp) const noexcept { std::fclose(fp); }
+};
+using file_ptr = std::unique_ptr<std::FILE, file_closer>;
+
+template <typename T>
+file_ptr make_input(const std::vector<T>& samples) {
+  file_ptr fp{std::tmpfile()};
+  // The data of an empty vector may be null, which must not be passed to `fwrite`.
+  if (!samples.empty()) {
+    std::fwrite(samples.data(), sizeof(T), samples.size(), fp.get());
+  }
+  std::rewind(fp.get());
+  return fp;
+}
+
+template <typename T>
+std::vector<T> read_all(std::FILE* fp) {
+  std::rewind(fp);
+  std::vector<T> result;
+  T x{};
+  while (std::fread(&x, sizeof(T), 1, fp) == 1) {
+    result.push_back(x);
+  }
+  return result;
+}
+}  // namespace
+
+TEST(SatChainTest, Apply) {
+  sat_chain<std::int16_t> chain;
+  chain.then(sat_op::kMul, 3).then(sat_op::kAdd, 100000).then(sat_op::kSub, 40000).then(sat_op::kDiv, -2);
+  EXPECT_EQ(chain.stages().size(), 4U);
+  EXPECT_EQ(chain.stages()[1].operand, std::numeric_limits<std::int16_t>::max());
+
+  komori::sat_array<std::int16_t> x{std::int16_t{-20000}, std::int16_t{0}, std::int16_t{20000}};
+  chain.apply(x);
+  // ((x * 3) + 32767 - 32767) / -2 with saturation at every step.
+  EXPECT_EQ(x[0], 16384);
+  EXPECT_EQ(x[1], 0);
+  EXPECT_EQ(x[2], 0);
+
+  EXPECT_THROW(chain.then(sat_op::kDiv, 0), std::invalid_argument);
+}
+
+TEST(SatChainTest, ApplyUnsigned) {
+  sat_chain<std::uint16_t> chain;
+  chain.then(sat_op::kAdd, -100).then(sat_op::kSub, -10).then(sat_op::kAdd, std::numeric_limits<std::int64_t>::min());
+  ASSERT_EQ(chain.stages().size(), 3U);
+  EXPECT_EQ(chain.stages()[0].op, sat_op::kSub);
+  EXPECT_EQ(chain.stages()[0].operand, std::uint16_t{100});
+  EXPECT_EQ(chain.stages()[1].op, sat_op::kAdd);
+  EXPECT_EQ(chain.stages()[1].operand, std::uint16_t{10});
+  EXPECT_EQ(chain.stages()[2].op, sat_op::kSub);
+  EXPECT_EQ(chain.stages()[2].operand, std::numeric_limits<std::uint16_t>::max());
+
+  komori::sat_array<std::uint16_t> x{std::uint16_t{1}, std::uint16_t{100}, std::uint16_t{1000}, std::uint16_t{60000}};
+  sat_chain<std::uint16_t> offset;
+  offset.then(sat_op::kAdd, -100);
+  offset.apply(x);
+  EXPECT_EQ(x[0], std::uint16_t{0});
+  EXPECT_EQ(x[1], std::uint16_t{0});
+  EXPECT_EQ(x[2], std::uint16_t{900});
+  EXPECT_EQ(x[3], std::uint16_t{59900});
+
+  EXPECT_THROW(chain.then(sat_op::kMul, -1), std::invalid_argument);
+  EXPECT_THROW(chain.then(sat_op::kDiv, -2), std::invalid_argument);
+  EXPECT_EQ(chain.stages().size(), 3U);
+}
+
+TEST(SatStreamTest, GainOffsetNarrow) {
+  // More samples than a few chunks, with a partial last chunk.
+  std::vector<std::int32_t> samples;
+  for (std::int32_t x = -100000; x <= 100000; x += 7) {
+    samples.push_back(x);
+  }
+  const file_ptr in = make_input(samples);
+  const file_ptr out{std::tmpfile()};
+
+  sat_chain<std::int32_t> chain;
+  chain.then(sat_op::kMul, 2).then(sat_op::kAdd, -5);
+  const auto stats = sat_transform_stream<std::int32_t, std::int16_t>(in.get(), out.get(), chain, 1000);
+
+  EXPECT_EQ(stats.samples, samples.size());
+  EXPECT_EQ(stats.bytes_read, samples.size() * sizeof(std::int32_t));
+  EXPECT_EQ(stats.bytes_written, samples.size() * sizeof(std::int16_t));
+
+  const auto result = read_all<std::int16_t>(out.get());
+  ASSERT_EQ(result.size(), samples.size());
+  for (std::size_t i = 0; i < samples.size(); ++i) {
+    ASSERT_EQ(result[i], saturate_cast<std::int16_t>(std::int64_t{samples[i]} * 2 - 5)) << "i: " << i;
+  }
+}
+
+TEST(SatStreamTest, Empty) {
+  const file_ptr in = make_input(std::vector<std::uint8_t>{});
+  const file_ptr out{std::tmpfile()};
+
+  const auto stats = sat_transform_stream<std::uint8_t, std::uint8_t>(in.get(), out.get(), {});
+  EXPECT_EQ(stats.samples, 0U);
+  EXPECT_TRUE(read_all<std::uint8_t>(out.get()).empty());
+}
+
+TEST(SatStreamTest, PartialSample) {
+  const file_ptr in = make_input(std::vector<std::uint8_t>{1, 2, 3});
+  const file_ptr out{std::tmpfile()};
+
+  EXPECT_THROW((sat_transform_stream<std::int16_t, std::int16_t>(in.get(), out.get(), {})), std::runtime_error);
+}
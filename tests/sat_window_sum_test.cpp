@@ -0,0 +1,136 @@
+#include "komori/sat_window_sum.hpp"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using komori::add_sat;
+using komori::sat_window_sum;
+using komori::sat_window_sums;
+using komori::saturate_cast;
+
+namespace {
+/// Recomputes the window from scratch. This is what `sat_window_sum` replaces.
+template <typename T>
+T naive_window_sum(const std::vector<T>& samples, std::size_t end, std::size_t n) {
+  const std::size_t begin = end > n ? end - n : 0;
+  std::int64_t sum = 0;
+  for (std::size_t i = begin; i < end; ++i) {
+    sum += samples[i];
+  }
+  return saturate_cast<T>(sum);
+}
+}  // namespace
+
+TEST(SatWindowSumTest, Empty) {
+  const sat_window_sum<std::int32_t, 4> window;
+
+  EXPECT_TRUE(window.empty());
+  EXPECT_FALSE(window.full());
+  EXPECT_EQ(window.size(), 0U);
+  EXPECT_EQ(window.value(), 0);
+  EXPECT_EQ((sat_window_sum<std::int32_t, 4>::capacity()), 4U);
+}
+
+TEST(SatWindowSumTest, PushAndPop) {
+  sat_window_sum<std::int8_t, 3> window;
+
+  window.push(10);
+  window.push(20);
+  EXPECT_EQ(window.value(), 30);
+  EXPECT_EQ(window.size(), 2U);
+
+  window.push(30);
+  EXPECT_TRUE(window.full());
+  EXPECT_EQ(window.value(), 60);
+
+  window.push(40);  // drops 10
+  EXPECT_EQ(window.value(), 90);
+  EXPECT_EQ(window.size(), 3U);
+
+  window.pop();  // drops 20
+  EXPECT_EQ(window.value(), 70);
+  window.pop();  // drops 30
+  EXPECT_EQ(window.value(), 40);
+  window.pop();  // drops 40
+  EXPECT_TRUE(window.empty());
+  EXPECT_EQ(window.value(), 0);
+}
+
+TEST(SatWindowSumTest, SaturatesOnlyOnRead) {
+  constexpr std::int32_t kMax = std::numeric_limits<std::int32_t>::max();
+  constexpr std::int32_t kMin = std::numeric_limits<std::int32_t>::min();
+  sat_window_sum<std::int32_t, 3> window;
+
+  window.push(kMax);
+  window.push(kMax);
+  EXPECT_EQ(window.value(), kMax);
+  EXPECT_EQ(window.sum(), std::int64_t{kMax} * 2);
+
+  window.push(kMin);
+  EXPECT_EQ(window.value(), kMax - 1);
+
+  window.push(kMin);  // drops the first kMax
+  window.push(kMin);  // drops the second kMax
+  EXPECT_EQ(window.value(), kMin);
+
+  window.clear();
+  EXPECT_TRUE(window.empty());
+  EXPECT_EQ(window.value(), 0);
+}
+
+TEST(SatWindowSumTest, Unsigned) {
+  constexpr std::uint16_t kMax = std::numeric_limits<std::uint16_t>::max();
+  sat_window_sum<std::uint16_t, 2> window;
+
+  window.push(kMax);
+  window.push(1);
+  EXPECT_EQ(window.value(), kMax);
+
+  window.push(2);
+  EXPECT_EQ(window.value(), 3);
+}
+
+TEST(SatWindowSumTest, MatchesFold) {
+  // All samples are non-negative, so the fold of add_sat never has to undo a saturation.
+  constexpr std::size_t kWindow = 16;
+  std::mt19937 engine{334};
+  std::uniform_int_distribution<std::int32_t> dist{0, std::numeric_limits<std::int16_t>::max() / 4};
+  sat_window_sum<std::int16_t, kWindow> window;
+  std::vector<std::int16_t> samples;
+
+  for (std::size_t i = 0; i < 1000; ++i) {
+    samples.push_back(static_cast<std::int16_t>(dist(engine)));
+    window.push(samples.back());
+
+    std::int16_t fold = 0;
+    for (std::size_t j = i + 1 > kWindow ? i + 1 - kWindow : 0; j <= i; ++j) {
+      fold = add_sat(fold, samples[j]);
+    }
+    ASSERT_EQ(window.value(), fold) << "i: " << i;
+  }
+}
+
+TEST(SatWindowSumTest, Stream) {
+  constexpr std::size_t kWindow = 5;
+  std::mt19937 engine{264};
+  std::uniform_int_distribution<std::int32_t> dist{std::numeric_limits<std::int16_t>::min(),
+                                                   std::numeric_limits<std::int16_t>::max()};
+  std::vector<std::int16_t> samples(100);
+  for (auto& sample : samples) {
+    sample = static_cast<std::int16_t>(dist(engine));
+  }
+
+  // Feed the samples in two chunks to check that the state carries over.
+  sat_window_sum<std::int16_t, kWindow> window;
+  std::vector<std::int16_t> sums(samples.size());
+  auto out = sat_window_sums(window, samples.begin(), samples.begin() + 37, sums.begin());
+  out = sat_window_sums(window, samples.begin() + 37, samples.end(), out);
+  EXPECT_EQ(out, sums.end());
+
+  for (std::size_t i = 0; i < samples.size(); ++i) {
+    ASSERT_EQ(sums[i], naive_window_sum(samples, i + 1, kWindow)) << "i: " << i;
+  }
+}
@@ -0,0 +1,218 @@
+#include "komori/sat_array.hpp"
+#include "komori/saturation_arithmetic.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+using komori::add_sat;
+using komori::div_sat;
+using komori::mul_sat;
+using komori::sat_array;
+using komori::sub_sat;
+using komori::detail::add_sat_wo_builtin;
+using komori::detail::mul_sat_wo_builtin;
+using komori::detail::sub_sat_wo_builtin;
+
+namespace {
+/// Computes `v` in 64-bit arithmetic and clamps it into the range of `T`. This is the reference implementation.
+template <typename T>
+T widen_clamp(std::int64_t v) {
+  const std::int64_t min = std::numeric_limits<T>::min();
+  const std::int64_t max = std::numeric_limits<T>::max();
+  return static_cast<T>(std::min(std::max(v, min), max));
+}
+
+/// Accumulates the comparison results without branching to keep the inner loop cheap.
+struct fast_checker {
+  template <typename T>
+  void operator()(T actual, T expected, const char* /* what */) noexcept {
+    ok &= actual == expected;
+  }
+
+  std::int64_t y{};
+  bool ok{true};
+};
+
+/// Reports every mismatch through gtest. Used to re-run a row which `fast_checker` rejected.
+struct reporting_checker {
+  template <typename T>
+  void operator()(T actual, T expected, const char* what) {
+    EXPECT_EQ(expected, actual) << what << " x: " << x << ", y: " << y;
+  }
+
+  std::int64_t x;
+  std::int64_t y{};
+};
+
+template <typename T, typename Checker, typename Op, typename CompoundOp>
+void check_sat_t(Checker& check, T x, T y, T expected, Op op, CompoundOp compound_op, const char* what) {
+  using sat = komori::detail::sat_t<T>;
+  const sat x_sat = x;
+  const sat y_sat = y;
+  sat tmp;
+
+  check(op(x_sat, y_sat).value(), expected, what);
+  check(op(x_sat, y).value(), expected, what);
+  check(op(x, y_sat).value(), expected, what);
+  tmp = x_sat;
+  check(compound_op(tmp, y_sat).value(), expected, what);
+  tmp = x_sat;
+  check(compound_op(tmp, y).value(), expected, what);
+}
+
+template <typename T, typename Checker>
+void check_pair(Checker& check, T x, T y) {
+  const std::int64_t wx = x;
+  const std::int64_t wy = y;
+
+  const T expected_add = widen_clamp<T>(wx + wy);
+  check(add_sat(x, y), expected_add, "add_sat");
+  check(add_sat_wo_builtin(x, y), expected_add, "add_sat_wo_builtin");
+  check_sat_t(
+      check, x, y, expected_add, [](auto a, auto b) { return a + b; }, [](auto& a, auto b) { return a += b; }, "+");
+
+  const T expected_sub = widen_clamp<T>(wx - wy);
+  check(sub_sat(x, y), expected_sub, "sub_sat");
+  check(sub_sat_wo_builtin(x, y), expected_sub, "sub_sat_wo_builtin");
+  check_sat_t(
+      check, x, y, expected_sub, [](auto a, auto b) { return a - b; }, [](auto& a, auto b) { return a -= b; }, "-");
+
+  const T expected_mul = widen_clamp<T>(wx * wy);
+  check(mul_sat(x, y), expected_mul, "mul_sat");
+  check(mul_sat_wo_builtin(x, y), expected_mul, "mul_sat_wo_builtin");
+  check_sat_t(
+      check, x, y, expected_mul, [](auto a, auto b) { return a * b; }, [](auto& a, auto b) { return a *= b; }, "*");
+
+  if (y == 0) {
+    return;
+  }
+
+  const T expected_div = widen_clamp<T>(wx / wy);
+  check(div_sat(x, y), expected_div, "div_sat");
+  check_sat_t(
+      check, x, y, expected_div, [](auto a, auto b) { return a / b; }, [](auto& a, auto b) { return a /= b; }, "/");
+}
+
+/// Every value of `T` in ascending order.
+template <typename T>
+sat_array<T> all_values() {
+  constexpr std::int64_t kMin = std::numeric_limits<T>::min();
+  constexpr std::int64_t kMax = std::numeric_limits<T>::max();
+  sat_array<T> values(static_cast<std::size_t>(kMax - kMin + 1));
+  for (std::int64_t y = kMin; y <= kMax; ++y) {
+    values[static_cast<std::size_t>(y - kMin)] = static_cast<T>(y);
+  }
+  return values;
+}
+
+/// Checks every pair in the row `x`. The `sat_array` bulk kernels process the whole row at once.
+template <typename T, typename Checker>
+void check_row(Checker& check, T x, const sat_array<T>& ys) {
+  const sat_array<T> xs(ys.size(), x);
+  const sat_array<T> sums = xs + ys;
+  const sat_array<T> diffs = xs - ys;
+  const sat_array<T> products = xs * ys;
+
+  const std::int64_t wx = x;
+  for (std::size_t i = 0; i < ys.size(); ++i) {
+    const T y = ys[i].value();
+    const std::int64_t wy = y;
+    check.y = wy;
+    check(sums[i].value(), widen_clamp<T>(wx + wy), "sat_array +");
+    check(diffs[i].value(), widen_clamp<T>(wx - wy), "sat_array -");
+    check(products[i].value(), widen_clamp<T>(wx * wy), "sat_array *");
+    check_pair(check, x, y);
+  }
+}
+
+struct exhaustive_result {
+  std::uint64_t pairs;
+  unsigned threads;
+  double seconds;
+  /// The smallest `x` whose row contains a mismatch, or `std::numeric_limits<std::int64_t>::max()` if none.
+  std::int64_t failed_x;
+};
+
+/**
+ * @brief Checks every `(x, y)` pair of `T` on all cores.
+ *
+ * Each worker pulls a whole row `x` at a time from a shared counter, so the load stays balanced even when some rows
+ * are cheaper than others (e.g. the division by zero row).
+ */
+template <typename T>
+exhaustive_result run_exhaustive() {
+  constexpr std::int64_t kMin = std::numeric_limits<T>::min();
+  constexpr std::int64_t kMax = std::numeric_limits<T>::max();
+  constexpr std::int64_t kNoFailure = std::numeric_limits<std::int64_t>::max();
+
+  const unsigned threads = std::max(1U, std::thread::hardware_concurrency());
+  std::atomic<std::int64_t> next_x{kMin};
+  std::atomic<std::int64_t> failed_x{kNoFailure};
+
+  const sat_array<T> ys = all_values<T>();
+  const auto worker = [&]() {
+    for (;;) {
+      const std::int64_t x = next_x.fetch_add(1, std::memory_order_relaxed);
+      if (x > kMax) {
+        break;
+      }
+
+      fast_checker check;
+      check_row(check, static_cast<T>(x), ys);
+
+      if (!check.ok) {
+        std::int64_t current = failed_x.load(std::memory_order_relaxed);
+        while (x < current && !failed_x.compare_exchange_weak(current, x, std::memory_order_relaxed)) {
+        }
+      }
+    }
+  };
+
+  const auto begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  pool.reserve(threads);
+  for (unsigned i = 0; i < threads; ++i) {
+    pool.emplace_back(worker);
+  }
+  for (auto& thread : pool) {
+    thread.join();
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  const std::uint64_t width = static_cast<std::uint64_t>(kMax - kMin + 1);
+  return {width * width, threads, std::chrono::duration<double>(end - begin).count(), failed_x.load()};
+}
+
+template <typename T>
+void expect_exhaustive(const char* type_name) {
+  const exhaustive_result result = run_exhaustive<T>();
+
+  const double mpairs_per_sec = static_cast<double>(result.pairs) / result.seconds / 1e6;
+  std::cout << "[ EXHAUST  ] " << type_name << ": " << result.pairs << " pairs in " << result.seconds << " s ("
+            << mpairs_per_sec << " Mpairs/s, " << result.threads << " threads)" << std::endl;
+  testing::Test::RecordProperty("mpairs_per_sec", std::to_string(mpairs_per_sec));
+
+  if (result.failed_x != std::numeric_limits<std::int64_t>::max()) {
+    // Re-run the first failing row with gtest assertions to get a readable report.
+    reporting_checker check{result.failed_x};
+    check_row(check, static_cast<T>(result.failed_x), all_values<T>());
+    FAIL() << "mismatch found in row x: " << result.failed_x;
+  }
+}
+}  // namespace
+
+TEST(Exhaustive16Test, Int16AllPairs) {
+  expect_exhaustive<std::int16_t>("int16_t");
+}
+
+TEST(Exhaustive16Test, Uint16AllPairs) {
+  expect_exhaustive<std::uint16_t>("uint16_t");
+}
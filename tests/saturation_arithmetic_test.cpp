@@ -3,15 +3,19 @@
 #include <gtest/gtest.h>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
+#include <utility>
 
 using komori::add_sat;
 using komori::div_sat;
+using komori::int_sat16_t;
 using komori::int_sat64_t;
 using komori::int_sat8_t;
 using komori::mul_sat;
 using komori::neg_sat;
 using komori::saturate_cast;
 using komori::sub_sat;
+using komori::uint_sat8_t;
 using komori::detail::add_sat_wo_builtin;
 using komori::detail::mul_sat_wo_builtin;
 using komori::detail::sub_sat_wo_builtin;
@@ -42,6 +46,21 @@ using integers = testing::Types<std::int8_t,
                                 std::uint32_t,
                                 std::uint64_t>;
 
+template <typename T, typename U, typename = void>
+struct has_plus : std::false_type {};
+template <typename T, typename U>
+struct has_plus<T, U, decltype(void(std::declval<T>() + std::declval<U>()))> : std::true_type {};
+
+template <typename T, typename U, typename = void>
+struct has_plus_assign : std::false_type {};
+template <typename T, typename U>
+struct has_plus_assign<T, U, decltype(void(std::declval<T&>() += std::declval<U>()))> : std::true_type {};
+
+template <typename T, typename U, typename = void>
+struct has_less : std::false_type {};
+template <typename T, typename U>
+struct has_less<T, U, decltype(void(std::declval<T>() < std::declval<U>()))> : std::true_type {};
+
 template <typename T>
 class AddSatTest : public testing::Test {};
 template <typename T>
@@ -232,6 +251,46 @@ TEST(SatTypeTest, TypeConversion) {
   }
 }
 
+// The C++14 (`std::enable_if_t`) and C++20 (concepts) overload sets must accept exactly the same expressions.
+TEST(SatTypeTest, OverloadSet) {
+  static_assert(std::is_convertible<std::int8_t, int_sat16_t>::value, "");
+  static_assert(!std::is_convertible<std::int16_t, int_sat8_t>::value, "");
+  static_assert(std::is_constructible<int_sat8_t, std::int16_t>::value, "");
+  static_assert(!std::is_convertible<std::uint8_t, int_sat16_t>::value, "");
+  static_assert(std::is_convertible<int_sat8_t, std::int16_t>::value, "");
+  static_assert(!std::is_convertible<int_sat16_t, std::int8_t>::value, "");
+  static_assert(std::is_constructible<std::int8_t, int_sat16_t>::value, "");
+  static_assert(!std::is_constructible<int_sat8_t, double>::value, "");
+
+  static_assert(std::is_same<decltype(int_sat8_t{} + int_sat16_t{}), int_sat16_t>::value, "");
+  static_assert(std::is_same<decltype(int_sat16_t{} * std::int8_t{}), int_sat16_t>::value, "");
+  static_assert(std::is_same<decltype(std::int8_t{} - int_sat16_t{}), int_sat16_t>::value, "");
+  static_assert(!has_plus<int_sat8_t, uint_sat8_t>::value, "");
+  static_assert(has_plus_assign<int_sat16_t, int_sat8_t>::value, "");
+  static_assert(has_plus_assign<int_sat16_t, std::int8_t>::value, "");
+  static_assert(!has_plus_assign<int_sat8_t, int_sat16_t>::value, "");
+  static_assert(!has_plus_assign<int_sat8_t, std::int16_t>::value, "");
+
+  static_assert(has_less<int_sat8_t, int_sat16_t>::value, "");
+  static_assert(has_less<std::int64_t, int_sat8_t>::value, "");
+  static_assert(!has_less<int_sat8_t, uint_sat8_t>::value, "");
+
+  EXPECT_TRUE(int_sat8_t{-1} < int_sat16_t{300});
+  EXPECT_TRUE(std::int64_t{300} > int_sat8_t{-1});
+  EXPECT_TRUE(int_sat16_t{300} != std::int8_t{44});
+}
+
+#if defined(KOMORI_TEST_EXPECT_CONCEPTS)
+TEST(SatTypeTest, UsesConcepts) {
+  // These concepts only exist in the C++20 overload set. If the header fell back to the C++14 overloads, this test
+  // would not compile.
+  static_assert(komori::detail::saturated<int_sat8_t>);
+  static_assert(!komori::detail::saturated<std::int8_t>);
+  static_assert(komori::detail::sat_operands<int_sat16_t, std::int8_t>);
+  static_assert(!komori::detail::sat_operands<int_sat8_t, uint_sat8_t>);
+}
+#endif
+
 TEST(SatTypeTest, Comparisons) {
   const std::int8_t s8min = std::numeric_limits<std::int8_t>::min();
   const std::int8_t s8max = std::numeric_limits<std::int8_t>::max();
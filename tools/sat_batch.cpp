@@ -0,0 +1,253 @@
+// sat_batch: applies a chain of saturating operations to a raw binary sample file without loading it into memory.
+//
+// Usage: sat_batch --in TYPE --out TYPE [--chunk SAMPLES] [OPERATION VALUE]... INPUT OUTPUT
+//
+//   TYPE       i8, i16, i32, i64, u8, u16, u32 or u64. Samples are native-endian.
+//   SAMPLES    The number of samples per chunk, from 1 to 2^28. The default is 2^20.
+//   OPERATION  --add, --sub, --mul, --div, --gain (= --mul) or --offset (= --add). Applied in the given order in the
+//              input type, then the result is saturated to the output type. For an unsigned input type, a negative
+//              --add or --sub subtracts or adds its magnitude, and a negative --mul or --div is an error.
+//
+// OUTPUT is written through a temporary file next to it, so it may be the same file as INPUT.
+//
+// Example: sat_batch --in i32 --out i16 --gain 3 --offset -100 input.raw output.raw
+#include "komori/sat_stream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+enum class sample_type { kI8, kI16, kI32, kI64, kU8, kU16, kU32, kU64 };
+
+struct options {
+  sample_type in;
+  sample_type out;
+  std::size_t chunk_samples = std::size_t{1} << 20;
+  std::vector<std::pair<komori::sat_op, std::int64_t>> ops;
+  std::string input;
+  std::string output;
+};
+
+/// The maximum of `--chunk`. Four buffers of this many samples are allocated.
+constexpr std::size_t kMaxChunkSamples = std::size_t{1} << 28;
+
+void usage() {
+  std::fputs(
+      "usage: sat_batch --in TYPE --out TYPE [--chunk SAMPLES] [OPERATION VALUE]... INPUT OUTPUT\n"
+      "  TYPE:      i8, i16, i32, i64, u8, u16, u32, u64\n"
+      "  OPERATION: --add, --sub, --mul, --div, --gain (= --mul), --offset (= --add)\n",
+      stderr);
+}
+
+sample_type parse_type(const std::string& name) {
+  const std::pair<const char*, sample_type> types[] = {
+      {"i8", sample_type::kI8},   {"i16", sample_type::kI16}, {"i32", sample_type::kI32}, {"i64", sample_type::kI64},
+      {"u8", sample_type::kU8},   {"u16", sample_type::kU16}, {"u32", sample_type::kU32}, {"u64", sample_type::kU64},
+  };
+  for (const auto& type : types) {
+    if (name == type.first) {
+      return type.second;
+    }
+  }
+  throw std::invalid_argument("unknown type: " + name);
+}
+
+/// Parses the whole of `value` as a decimal integer. `std::stoll` alone accepts trailing garbage such as "3.5".
+std::int64_t parse_int(const std::string& arg, const std::string& value) {
+  std::size_t pos = 0;
+  std::int64_t result = 0;
+  try {
+    result = std::stoll(value, &pos);
+  } catch (const std::logic_error&) {
+    pos = 0;
+  }
+  if (pos == 0 || pos != value.size()) {
+    throw std::invalid_argument("invalid integer for " + arg + ": " + value);
+  }
+  return result;
+}
+
+options parse_options(int argc, char** argv) {
+  const std::pair<const char*, komori::sat_op> op_flags[] = {
+      {"--add", komori::sat_op::kAdd},  {"--offset", komori::sat_op::kAdd}, {"--sub", komori::sat_op::kSub},
+      {"--mul", komori::sat_op::kMul},  {"--gain", komori::sat_op::kMul},   {"--div", komori::sat_op::kDiv},
+  };
+
+  options opts{};
+  bool has_in = false;
+  bool has_out = false;
+  std::vector<std::string> positional;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg.size() < 2 || arg.compare(0, 2, "--") != 0) {
+      positional.push_back(arg);
+      continue;
+    }
+    if (i + 1 >= argc) {
+      throw std::invalid_argument("missing value for " + arg);
+    }
+
+    const std::string value = argv[++i];
+    if (arg == "--in") {
+      opts.in = parse_type(value);
+      has_in = true;
+    } else if (arg == "--out") {
+      opts.out = parse_type(value);
+      has_out = true;
+    } else if (arg == "--chunk") {
+      const std::int64_t chunk = parse_int(arg, value);
+      if (chunk <= 0 || static_cast<std::uint64_t>(chunk) > kMaxChunkSamples) {
+        throw std::invalid_argument("--chunk must be between 1 and " + std::to_string(kMaxChunkSamples));
+      }
+      opts.chunk_samples = static_cast<std::size_t>(chunk);
+    } else {
+      bool found = false;
+      for (const auto& flag : op_flags) {
+        if (arg == flag.first) {
+          opts.ops.emplace_back(flag.second, parse_int(arg, value));
+          found = true;
+        }
+      }
+      if (!found) {
+        throw std::invalid_argument("unknown option: " + arg);
+      }
+    }
+  }
+
+  if (!has_in || !has_out || positional.size() != 2) {
+    throw std::invalid_argument("--in, --out, INPUT and OUTPUT are required");
+  }
+  opts.input = positional[0];
+  opts.output = positional[1];
+  return opts;
+}
+
+struct file_closer {
+  void operator()(std::FILE* fp) const noexcept { std::fclose(fp); }
+};
+using file_ptr = std::unique_ptr<std::FILE, file_closer>;
+
+file_ptr open_file(const std::string& path, const char* mode) {
+  file_ptr fp{std::fopen(path.c_str(), mode)};
+  if (!fp) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  return fp;
+}
+
+/// Moves `from` to `to`, replacing `to`. On failure `from` is kept so that the result is not lost.
+void replace_file(const std::string& from, const std::string& to) {
+  if (std::rename(from.c_str(), to.c_str()) == 0) {
+    return;
+  }
+  // `std::rename` does not replace an existing file on Windows.
+  if (std::remove(to.c_str()) == 0 && std::rename(from.c_str(), to.c_str()) == 0) {
+    return;
+  }
+  throw std::runtime_error("cannot replace " + to + ", the result is left in " + from);
+}
+
+template <typename In, typename Out>
+komori::sat_stream_stats run(const options& opts) {
+  komori::sat_chain<In> chain;
+  for (const auto& op : opts.ops) {
+    chain.then(op.first, op.second);
+  }
+
+  // Write to a temporary file and rename it at the end. Opening OUTPUT directly would truncate INPUT before it is
+  // read if both are the same file.
+  const std::string temp = opts.output + ".sat_batch.tmp";
+  komori::sat_stream_stats stats{};
+  try {
+    const file_ptr in = open_file(opts.input, "rb");
+    file_ptr out = open_file(temp, "wb");
+    stats = komori::sat_transform_stream<In, Out>(in.get(), out.get(), chain, opts.chunk_samples);
+    if (std::fclose(out.release()) != 0) {
+      throw std::runtime_error("cannot write " + temp);
+    }
+  } catch (...) {
+    std::remove(temp.c_str());
+    throw;
+  }
+
+  replace_file(temp, opts.output);
+  return stats;
+}
+
+template <typename In>
+komori::sat_stream_stats dispatch_out(const options& opts) {
+  switch (opts.out) {
+    case sample_type::kI8:
+      return run<In, std::int8_t>(opts);
+    case sample_type::kI16:
+      return run<In, std::int16_t>(opts);
+    case sample_type::kI32:
+      return run<In, std::int32_t>(opts);
+    case sample_type::kI64:
+      return run<In, std::int64_t>(opts);
+    case sample_type::kU8:
+      return run<In, std::uint8_t>(opts);
+    case sample_type::kU16:
+      return run<In, std::uint16_t>(opts);
+    case sample_type::kU32:
+      return run<In, std::uint32_t>(opts);
+    case sample_type::kU64:
+      return run<In, std::uint64_t>(opts);
+  }
+  throw std::logic_error("unreachable");
+}
+
+komori::sat_stream_stats dispatch(const options& opts) {
+  switch (opts.in) {
+    case sample_type::kI8:
+      return dispatch_out<std::int8_t>(opts);
+    case sample_type::kI16:
+      return dispatch_out<std::int16_t>(opts);
+    case sample_type::kI32:
+      return dispatch_out<std::int32_t>(opts);
+    case sample_type::kI64:
+      return dispatch_out<std::int64_t>(opts);
+    case sample_type::kU8:
+      return dispatch_out<std::uint8_t>(opts);
+    case sample_type::kU16:
+      return dispatch_out<std::uint16_t>(opts);
+    case sample_type::kU32:
+      return dispatch_out<std::uint32_t>(opts);
+    case sample_type::kU64:
+      return dispatch_out<std::uint64_t>(opts);
+  }
+  throw std::logic_error("unreachable");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  options opts;
+  try {
+    opts = parse_options(argc, argv);
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "sat_batch: %s\n", e.what());
+    usage();
+    return EXIT_FAILURE;
+  }
+
+  try {
+    const komori::sat_stream_stats stats = dispatch(opts);
+    const double bytes = static_cast<double>(stats.bytes_read + stats.bytes_written);
+    std::fprintf(stderr, "sat_batch: %llu samples, %llu bytes in, %llu bytes out, %.3f s, %.3f GB/s\n",
+                 static_cast<unsigned long long>(stats.samples), static_cast<unsigned long long>(stats.bytes_read),
+                 static_cast<unsigned long long>(stats.bytes_written), stats.seconds,
+                 stats.seconds > 0 ? bytes / stats.seconds / 1e9 : 0.0);
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "sat_batch: %s\n", e.what());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}